@@ -0,0 +1,213 @@
+// Build step for embedded word packs: turns the .txt packs listed in word_packs.def (the same list
+// word_pack_paths is built from) into a header of read-only tables that hangman.c compiles in
+// with -DHANGMAN_EMBEDDED_PACKS. Run it from the directory holding the packs:
+//
+//   gcc embed_packs.c -o embed_packs
+//   ./embed_packs > embedded_packs.h
+//
+// Each pack becomes `embedded_pack_<id>` with the id from word_packs.def.
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    const char* id;
+    const char* path;
+} PackSource;
+
+static const PackSource pack_sources[] = {
+#define WORD_PACK(id, name, path) {#id, path},
+#include "word_packs.def"
+#undef WORD_PACK
+};
+
+#define NUMBER_OF_PACKS ((int)(sizeof(pack_sources) / sizeof(pack_sources[0])))
+
+typedef struct {
+    char* text;
+    int length;
+    int order;  // position in the file, keeps the sort stable
+} PackWord;
+
+typedef struct {
+    PackWord* data;
+    int size;
+    int cap;
+} PackWordList;
+
+static void pwl_push(PackWordList* l, const char* s, int length) {
+    if (l->size == l->cap) {
+        int newCap = l->cap == 0 ? 16 : l->cap * 2;
+        PackWord* newData = (PackWord*)realloc(l->data, newCap * sizeof(PackWord));
+        if (newData == NULL) {
+            printf("realloc error\n");
+            exit(1);
+        }
+        l->data = newData;
+        l->cap = newCap;
+    }
+    char* copy = (char*)malloc(length + 1);
+    if (copy == NULL) {
+        printf("malloc error\n");
+        exit(1);
+    }
+    memcpy(copy, s, length + 1);
+    l->data[l->size].text = copy;
+    l->data[l->size].length = length;
+    l->data[l->size].order = l->size;
+    l->size++;
+}
+
+static void pwl_free(PackWordList* l) {
+    for (int i = 0; i < l->size; ++i) free(l->data[i].text);
+    free(l->data);
+}
+
+static int compare_length(const void* a, const void* b) {
+    const PackWord* x = (const PackWord*)a;
+    const PackWord* y = (const PackWord*)b;
+    if (x->length != y->length) return x->length - y->length;
+    return x->order - y->order;
+}
+
+// same line handling as try_load_words in hangman.c
+static void read_pack(const char* filename, PackWordList* out) {
+    FILE* f = fopen(filename, "r");
+    if (!f) {
+        perror(filename);
+        exit(1);
+    }
+    char buf[256];
+    while (fgets(buf, sizeof buf, f)) {
+        size_t len = strlen(buf);
+        while (len && (buf[len - 1] == '\n' || buf[len - 1] == '\r'))
+            buf[--len] = '\0';
+        if (len == 0) continue;
+        pwl_push(out, buf, (int)len);
+    }
+    fclose(f);
+    if (out->size == 0) {
+        fprintf(stderr, "%s: no words loaded\n", filename);
+        exit(1);
+    }
+}
+
+// same letter handling as pick_dynamic_word: case-insensitive, a-z only
+static uint32_t letter_mask(const char* w) {
+    uint32_t mask = 0;
+    for (const char* p = w; *p; ++p) {
+        char lc = (char)tolower((unsigned char)*p);
+        if (lc >= 'a' && lc <= 'z') mask |= 1u << (lc - 'a');
+    }
+    return mask;
+}
+
+static void print_string_literal(const char* s) {
+    putchar('"');
+    for (const char* p = s; *p; ++p) {
+        if (*p == '"' || *p == '\\')
+            printf("\\%c", *p);
+        else if (isprint((unsigned char)*p))
+            putchar(*p);
+        else
+            printf("\\%03o", (unsigned char)*p);
+    }
+    putchar('"');
+}
+
+// first index whose word is at least min_length long
+static int first_with_length(const PackWordList* l, int min_length) {
+    int i = 0;
+    while (i < l->size && l->data[i].length < min_length) i++;
+    return i;
+}
+
+// Every table is a flat array of numbers or characters shared by all packs, and each
+// EmbeddedPack only stores indexes into them. Nothing needs relocating at load time,
+// so it all stays in .rodata and is shared between processes running the game.
+static void emit_packs(void) {
+    int count = NUMBER_OF_PACKS;
+    PackWordList* packs = (PackWordList*)calloc(count, sizeof(PackWordList));
+    if (packs == NULL) {
+        printf("malloc error\n");
+        exit(1);
+    }
+    for (int p = 0; p < count; ++p) {
+        read_pack(pack_sources[p].path, &packs[p]);
+        qsort(packs[p].data, packs[p].size, sizeof(PackWord), compare_length);
+    }
+
+    printf("\nstatic const char embedded_text[] =");
+    for (int p = 0; p < count; ++p) {
+        printf("\n    // %s: %d words", pack_sources[p].path, packs[p].size);
+        for (int i = 0; i < packs[p].size; ++i) {
+            printf("\n    ");
+            print_string_literal(packs[p].data[i].text);
+            printf(" \"\\0\"");
+        }
+    }
+    printf(";\n");
+
+    // start of each word in embedded_text
+    uint32_t offset = 0;
+    printf("static const uint32_t embedded_offsets[] = {\n");
+    for (int p = 0; p < count; ++p) {
+        for (int i = 0; i < packs[p].size; ++i) {
+            printf("    %u,\n", (unsigned)offset);
+            offset += (uint32_t)packs[p].data[i].length + 1;
+        }
+    }
+    printf("};\n");
+
+    // bit i set if the word contains 'a' + i
+    printf("static const uint32_t embedded_masks[] = {\n");
+    for (int p = 0; p < count; ++p) {
+        for (int i = 0; i < packs[p].size; ++i) {
+            printf("    0x%08xu,\n", (unsigned)letter_mask(packs[p].data[i].text));
+        }
+    }
+    printf("};\n");
+
+    // per pack: words of length n start at entry n of the pack's slice
+    printf("static const int embedded_length_starts[] = {\n");
+    for (int p = 0; p < count; ++p) {
+        int max_length = packs[p].data[packs[p].size - 1].length;
+        printf("    ");
+        for (int n = 0; n <= max_length + 1; ++n) {
+            printf("%s%d", n ? ", " : "", first_with_length(&packs[p], n));
+        }
+        printf(",\n");
+    }
+    printf("};\n");
+
+    int first = 0;
+    int length_starts = 0;
+    for (int p = 0; p < count; ++p) {
+        int size = packs[p].size;
+        int max_length = packs[p].data[size - 1].length;
+        // difficulty bounds match pick_random_word: easy < 5, medium 5-8, hard > 8, evil any
+        int medium = first_with_length(&packs[p], 5);
+        int hard = first_with_length(&packs[p], 9);
+        printf("\nstatic const EmbeddedPack embedded_pack_%s = {\n", pack_sources[p].id);
+        printf("    %d,\n", first);
+        printf("    %d,\n", size);
+        printf("    %d,\n", length_starts);
+        printf("    %d,\n", max_length);
+        printf("    {{0, 0}, {0, %d}, {%d, %d}, {%d, %d}, {0, %d}},\n", medium, medium, hard, hard, size, size);
+        printf("};\n");
+        first += size;
+        length_starts += max_length + 2;
+        pwl_free(&packs[p]);
+    }
+    free(packs);
+}
+
+int main(void) {
+    printf("// Generated by embed_packs from word_packs.def. Do not edit.\n");
+    printf("// Words are sorted by length within each pack. Included by hangman.c, which defines EmbeddedPack.\n");
+    printf("\n#define EMBEDDED_PACK_COUNT %d  // checked against word_pack_paths\n", NUMBER_OF_PACKS);
+    emit_packs();
+    return 0;
+}
@@ -1,4 +1,6 @@
 #include <ctype.h>
+#include <errno.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -8,19 +10,63 @@
 
 #include "hangman_char.h"
 
+// a word pack compiled into the binary by embed_packs, with its indexes precomputed at build time.
+// holds no pointers, only indexes into the shared embedded_* tables, so everything stays in .rodata
+typedef struct {
+    int first;                   // the pack's first word in embedded_offsets and embedded_masks
+    int size;                    // words are sorted by length, shortest first
+    int length_starts;           // the pack's slice of embedded_length_starts
+    int max_length;
+    int difficulty_range[5][2];  // [first, end) of the words for each difficulty (1-4)
+} EmbeddedPack;
+
+#ifdef HANGMAN_EMBEDDED_PACKS
+#include "embedded_packs.h"  // generated, see embed_packs.c
+#define EMBEDDED(pack) (&(pack))
+#else
+#define EMBEDDED(pack) NULL
+// nothing compiled in. these keep the embedded code paths building, they are never reached
+static const char embedded_text[] = "";
+static const uint32_t embedded_offsets[1] = {0};
+static const uint32_t embedded_masks[1] = {0};
+static const int embedded_length_starts[1] = {0};
+#endif
+
+static const char* embedded_word(const EmbeddedPack* pack, int i) {
+    return embedded_text + embedded_offsets[pack->first + i];
+}
+
+// bit i set if the word contains 'a' + i
+static uint32_t embedded_letter_mask(const EmbeddedPack* pack, int i) {
+    return embedded_masks[pack->first + i];
+}
+
+// words of length n are [embedded_length_start(pack, n), embedded_length_start(pack, n + 1))
+static int embedded_length_start(const EmbeddedPack* pack, int n) {
+    return embedded_length_starts[pack->length_starts + n];
+}
+
 typedef struct {
     char name[50];
     char path[100];
+    const EmbeddedPack* embedded;  // NULL to load from path at runtime
 } WordPack;
 
 WordPack word_pack_paths[] = {
-    {"Default", "default.txt"},
-    {"Engineering", "engineering.txt"},
-    {"Countries", "countries.txt"},
+#define WORD_PACK(id, name, path) {name, path, EMBEDDED(embedded_pack_##id)},
+#include "word_packs.def"
+#undef WORD_PACK
 };
 
+#define NUMBER_OF_PACKS ((int)(sizeof(word_pack_paths) / sizeof(word_pack_paths[0])))
+
+#ifdef HANGMAN_EMBEDDED_PACKS
+_Static_assert(EMBEDDED_PACK_COUNT == NUMBER_OF_PACKS, "embedded_packs.h is out of date, rerun embed_packs");
+#endif
+#define ALL_PACKS_CHOICE (NUMBER_OF_PACKS + 1)  // menu entry that combines every pack
+
 typedef struct {
-    char** data;
+    const char** data;  // read-only words: copies owned by the list, or borrowed for views
     int size;  // current number of elements
     int cap;   // current max capacity
 } StringList;  // to store list of words dynamically
@@ -31,16 +77,16 @@ void sl_init(StringList* sl) {
     sl->cap = 0;
 }
 
-void sl_push(StringList* sl, const char* s) {
+static void sl_grow(StringList* sl) {
     // if at full capacity 
     if (sl->size == sl->cap) {
         int newCap;
-        char** newData;
+        const char** newData;
         if (sl->cap == 0)
             newCap = 2;
         else
             newCap = sl->cap * 2;
-        newData = (char**)realloc(sl->data, newCap * sizeof(char*));
+        newData = (const char**)realloc(sl->data, newCap * sizeof(char*));
         if (newData == NULL) {
             printf("realloc error\n");
             exit(1);
@@ -48,6 +94,10 @@ void sl_push(StringList* sl, const char* s) {
         sl->data = newData;
         sl->cap = newCap;
     }
+}
+
+void sl_push(StringList* sl, const char* s) {
+    sl_grow(sl);
 
     size_t len = strlen(s);
     char* copy = (char*)malloc(len + 1);
@@ -62,10 +112,22 @@ void sl_push(StringList* sl, const char* s) {
 
 void sl_free(StringList* sl) {
     for (size_t i = 0; i < sl->size; ++i)
-        free(sl->data[i]);
+        free((char*)sl->data[i]);  // copies made by sl_push
     free(sl->data);
 }
 
+// push without copying: the list only borrows s, so free it with sl_free_view
+void sl_push_ref(StringList* sl, const char* s) {
+    sl_grow(sl);
+    sl->data[sl->size] = s;
+    sl->size = sl->size + 1;
+}
+
+void sl_free_view(StringList* sl) {
+    free(sl->data);
+    sl_init(sl);
+}
+
 typedef struct GuessNode {
     char ch;
     struct GuessNode* next;
@@ -117,7 +179,7 @@ void score_inc_win(Score* s) { s->wins++; }
 void score_inc_loss(Score* s) { s->losses++; }
 
 typedef struct {
-    char* word;            // owned elsewhere (from words list)
+    const char* word;      // owned elsewhere (from words list)
     char* renderedString;  // same length as word, underscores + revealed letters
     int incorrectGuesses;
     int difficulty;  // 0 to 4
@@ -125,7 +187,7 @@ typedef struct {
     int hints_used;  // number of hints used
 } Board;
 
-void board_reset(Board* b, char* word) {
+void board_reset(Board* b, const char* word) {
     b->hints_used = 0;  // reset hints used each round
 
     b->word = word;
@@ -220,12 +282,11 @@ static void give_hint(Board* b, GuessNode** guesses) {
     printf("Hint: revealed letter '%c'\n", letter);
 }
 
-void load_words(const char* filename, StringList* out) {
+// read one word per line into out. reports failure instead of exiting, since it runs on the loader thread.
+// returns 0 on success, an errno value if the file can't be opened, or -1 if it has no words
+static int try_load_words(const char* filename, StringList* out) {
     FILE* f = fopen(filename, "r");
-    if (!f) {
-        perror("fopen error");
-        exit(1);
-    }
+    if (!f) return errno;
     char buf[256];  // 256 max line length for now
     while (fgets(buf, sizeof buf, f)) {
         // trim newline terminator
@@ -236,20 +297,280 @@ void load_words(const char* filename, StringList* out) {
         sl_push(out, buf);
     }
     fclose(f);
-    if (out->size == 0) {
-        perror("no words loaded");
-        exit(1);
+    return out->size == 0 ? -1 : 0;
+}
+
+// Pack cache: packs are loaded on a background thread as soon as they are selected (or preloaded),
+// and stay in memory so switching between rounds doesn't reload them. Each user holds a reference;
+// once the cache is over PACK_CACHE_MAX_BYTES, unreferenced packs are evicted least recently used first.
+#define PACK_CACHE_MAX_BYTES (1024 * 1024)
+
+typedef enum { PACK_EMPTY, PACK_LOADING, PACK_READY, PACK_FAILED } PackState;
+
+typedef struct {
+    StringList words;
+    PackState state;
+    bool owned;               // words were copied by sl_push and must be freed, false for embedded packs
+    int refs;                 // number of active users, only packs with 0 refs can be evicted
+    int error;                // try_load_words result when state is PACK_FAILED
+    size_t bytes;             // approximate memory held by words
+    unsigned long last_used;  // pack_cache_clock value at last use
+} PackCacheEntry;
+
+static PackCacheEntry pack_cache[NUMBER_OF_PACKS];
+static size_t pack_cache_bytes = 0;
+static unsigned long pack_cache_clock = 0;
+static pthread_mutex_t pack_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pack_cache_changed = PTHREAD_COND_INITIALIZER;
+
+static size_t string_list_bytes(const StringList* sl) {
+    size_t bytes = (size_t)sl->cap * sizeof(char*);
+    for (int i = 0; i < sl->size; ++i) bytes += strlen(sl->data[i]) + 1;
+    return bytes;
+}
+
+// free the entry's words (only the pointer array for embedded packs) and mark it empty
+static void pack_cache_clear_locked(PackCacheEntry* e) {
+    if (e->owned)
+        sl_free(&e->words);
+    else
+        sl_free_view(&e->words);
+    sl_init(&e->words);
+    e->owned = false;
+    pack_cache_bytes -= e->bytes;
+    e->bytes = 0;
+    e->state = PACK_EMPTY;
+}
+
+// evict unused packs until under the cap. keep is a pack index that must stay (-1 for none)
+static void pack_cache_trim_locked(int keep) {
+    while (pack_cache_bytes > PACK_CACHE_MAX_BYTES) {
+        int victim = -1;
+        for (int i = 0; i < NUMBER_OF_PACKS; ++i) {
+            if (i == keep || pack_cache[i].state != PACK_READY || pack_cache[i].refs > 0) continue;
+            if (!pack_cache[i].owned) continue;  // lives in the binary, nothing to free
+            if (victim < 0 || pack_cache[i].last_used < pack_cache[victim].last_used) victim = i;
+        }
+        if (victim < 0) break;  // everything left is in use
+        pack_cache_clear_locked(&pack_cache[victim]);
+    }
+}
+
+static void* pack_loader_thread(void* arg) {
+    int index = (int)(intptr_t)arg;
+    StringList words;
+    sl_init(&words);
+    int err = try_load_words(word_pack_paths[index].path, &words);
+    size_t bytes = err == 0 ? string_list_bytes(&words) : 0;  // measured before locking, it scans the pack
+
+    pthread_mutex_lock(&pack_cache_lock);
+    PackCacheEntry* e = &pack_cache[index];
+    if (err == 0) {
+        e->words = words;
+        e->owned = true;
+        e->bytes = bytes;
+        e->last_used = ++pack_cache_clock;
+        e->state = PACK_READY;
+        pack_cache_bytes += e->bytes;
+        pack_cache_trim_locked(index);
+    } else {
+        sl_free(&words);
+        e->error = err;
+        e->state = PACK_FAILED;
+    }
+    pthread_cond_broadcast(&pack_cache_changed);
+    pthread_mutex_unlock(&pack_cache_lock);
+    return NULL;
+}
+
+static void pack_cache_preload_locked(int index) {
+    PackCacheEntry* e = &pack_cache[index];
+    if (e->state != PACK_EMPTY && e->state != PACK_FAILED) return;  // already loaded or loading
+
+    const EmbeddedPack* embedded = word_pack_paths[index].embedded;
+    if (embedded) {
+        // view borrowing the compiled-in words. owned stays false so only the view is freed
+        for (int i = 0; i < embedded->size; ++i) sl_push_ref(&e->words, embedded_word(embedded, i));
+        e->last_used = ++pack_cache_clock;
+        e->state = PACK_READY;
+        return;
+    }
+
+    pthread_t thread;
+    e->state = PACK_LOADING;
+    int rc = pthread_create(&thread, NULL, pack_loader_thread, (void*)(intptr_t)index);
+    if (rc != 0) {
+        e->error = rc;
+        e->state = PACK_FAILED;
+        return;
     }
+    pthread_detach(thread);
 }
 
-char* pick_random_word(const StringList* sl, int difficulty) {
-    // Filter words based on difficulty
+// start loading a pack in the background without waiting for it
+void pack_cache_preload(int index) {
+    pthread_mutex_lock(&pack_cache_lock);
+    pack_cache_preload_locked(index);
+    pthread_mutex_unlock(&pack_cache_lock);
+}
+
+// wait for a pack to finish loading and take a reference to it. returns NULL if it can't be loaded
+const StringList* pack_cache_acquire(int index) {
+    PackCacheEntry* e = &pack_cache[index];
+    const StringList* words = NULL;
+
+    pthread_mutex_lock(&pack_cache_lock);
+    pack_cache_preload_locked(index);
+    if (e->state == PACK_LOADING) {
+        printf("Loading %s...\n", word_pack_paths[index].name);
+    }
+    while (e->state != PACK_READY && e->state != PACK_FAILED) {
+        // another loader finishing can evict the pack before we wake up and take our reference
+        if (e->state == PACK_EMPTY)
+            pack_cache_preload_locked(index);
+        else
+            pthread_cond_wait(&pack_cache_changed, &pack_cache_lock);
+    }
+    if (e->state == PACK_READY) {
+        e->refs++;
+        e->last_used = ++pack_cache_clock;
+        words = &e->words;
+    }
+    int err = e->error;
+    pthread_mutex_unlock(&pack_cache_lock);
+
+    if (words == NULL) {
+        if (err > 0)
+            printf("Could not load %s: %s\n", word_pack_paths[index].path, strerror(err));
+        else
+            printf("Could not load %s: no words loaded\n", word_pack_paths[index].path);
+    }
+    return words;
+}
+
+void pack_cache_release(int index) {
+    pthread_mutex_lock(&pack_cache_lock);
+    pack_cache[index].refs--;
+    pack_cache_trim_locked(-1);
+    pthread_mutex_unlock(&pack_cache_lock);
+}
+
+// wait for any loads still in flight, then free every cached pack
+void pack_cache_shutdown(void) {
+    pthread_mutex_lock(&pack_cache_lock);
+    for (int i = 0; i < NUMBER_OF_PACKS; ++i) {
+        while (pack_cache[i].state == PACK_LOADING) pthread_cond_wait(&pack_cache_changed, &pack_cache_lock);
+        pack_cache_clear_locked(&pack_cache[i]);
+    }
+    pthread_mutex_unlock(&pack_cache_lock);
+}
+
+// the pack currently used for play: a single cached pack, or a view over all of them
+typedef struct {
+    int choice;               // 1..NUMBER_OF_PACKS, or ALL_PACKS_CHOICE
+    StringList all;           // borrowed pointers into every pack, only used for ALL_PACKS_CHOICE
+    const StringList* pack;   // the cached pack, only used for a single pack
+    const EmbeddedPack* embedded;  // precomputed indexes for the single pack, NULL if there are none
+} ActivePack;
+
+// list to pick words from. resolved on each call so ActivePack can be copied freely
+const StringList* active_pack_words(const ActivePack* ap) {
+    return ap->choice == ALL_PACKS_CHOICE ? &ap->all : ap->pack;
+}
+
+const char* pack_choice_name(int choice) {
+    return choice == ALL_PACKS_CHOICE ? "All packs" : word_pack_paths[choice - 1].name;
+}
+
+void pack_choice_preload(int choice) {
+    if (choice != ALL_PACKS_CHOICE) {
+        pack_cache_preload(choice - 1);
+        return;
+    }
+    for (int i = 0; i < NUMBER_OF_PACKS; ++i) pack_cache_preload(i);
+}
+
+// returns 0 on success. on failure ap is left untouched
+int active_pack_open(ActivePack* ap, int choice) {
+    ActivePack next;
+    next.choice = choice;
+    next.pack = NULL;
+    next.embedded = NULL;
+    sl_init(&next.all);
+
+    if (choice != ALL_PACKS_CHOICE) {
+        next.embedded = word_pack_paths[choice - 1].embedded;
+        next.pack = pack_cache_acquire(choice - 1);
+        if (next.pack == NULL) return -1;
+        *ap = next;
+        return 0;
+    }
+    // hold every pack while the combined view points into them
+    for (int i = 0; i < NUMBER_OF_PACKS; ++i) {
+        const StringList* pack = pack_cache_acquire(i);
+        if (pack == NULL) {
+            while (i-- > 0) pack_cache_release(i);
+            sl_free_view(&next.all);
+            return -1;
+        }
+        for (int j = 0; j < pack->size; ++j) sl_push_ref(&next.all, pack->data[j]);
+    }
+    *ap = next;
+    return 0;
+}
+
+void active_pack_close(ActivePack* ap) {
+    if (ap->choice != ALL_PACKS_CHOICE) {
+        pack_cache_release(ap->choice - 1);
+        return;
+    }
+    sl_free_view(&ap->all);
+    for (int i = 0; i < NUMBER_OF_PACKS; ++i) pack_cache_release(i);
+}
+
+// switch to another pack, opening it before releasing the old one so packs they share stay cached.
+// returns 0 on success. on failure ap keeps its current pack
+int active_pack_switch(ActivePack* ap, int choice) {
+    ActivePack next;
+    if (active_pack_open(&next, choice) != 0) return -1;
+    active_pack_close(ap);
+    *ap = next;
+    return 0;
+}
+
+// show the word pack menu and start loading the chosen pack in the background
+int choose_word_pack(void) {
+    int choice;
+    printf("\nWhich word pack would you like to use?\n");
+    for (int i = 0; i < NUMBER_OF_PACKS; ++i) {
+        printf("%d: %s\n", i + 1, word_pack_paths[i].name);
+    }
+    printf("%d: %s\n", ALL_PACKS_CHOICE, pack_choice_name(ALL_PACKS_CHOICE));
+    printf("Enter choice (1-%d): ", ALL_PACKS_CHOICE);
+    while (true) {
+        if (scanf(" %d", &choice) != 1) {
+            printf("\nInvalid input, try again: \n");
+            while (getchar() != '\n');  // clear input buffer
+            continue;
+        }
+        if (choice < 1 || choice > ALL_PACKS_CHOICE) {
+            printf("\nOut of range, try again: \n");
+            continue;
+        }
+        break;
+    }
+    pack_choice_preload(choice);
+    return choice;
+}
+
+const char* pick_random_word(const StringList* sl, int difficulty) {
+    // Filter words based on difficulty. filtered borrows from sl, which stays alive for the round
     StringList filtered;
     sl_init(&filtered);
 
     if (difficulty == 4) {  // Evil Hangman mode, pick any word
         for (size_t i = 0; i < sl->size; ++i) {
-            sl_push(&filtered, sl->data[i]);
+            sl_push_ref(&filtered, sl->data[i]);
         }
     } else {
         for (size_t i = 0; i < sl->size; ++i) {
@@ -257,20 +578,37 @@ char* pick_random_word(const StringList* sl, int difficulty) {
             if ((difficulty == 1 && len < 5) ||               // easy
                 (difficulty == 2 && len >= 5 && len <= 8) ||  // medium
                 (difficulty == 3 && len > 8)) {               // hard
-                sl_push(&filtered, sl->data[i]);
+                sl_push_ref(&filtered, sl->data[i]);
             }
         }
     }
+    const char* word;
     if (filtered.size == 0) {
         printf("No words available for the selected difficulty. Using all words.\n");
-        return sl->data[rand() % sl->size];
+        word = sl->data[rand() % sl->size];
     } else {
-        return filtered.data[rand() % filtered.size];
+        word = filtered.data[rand() % filtered.size];
     }
-    sl_free(&filtered);
+    sl_free_view(&filtered);
+    return word;
 }
 
-char* pick_dynamic_word(const StringList* sl, const Board* b, char guess, int word_length, GuessNode** guesses) {
+// same as pick_random_word, but uses the pack's precomputed difficulty ranges instead of filtering
+const char* pick_embedded_word(const EmbeddedPack* pack, int difficulty) {
+    int first = pack->difficulty_range[difficulty][0];
+    int end = pack->difficulty_range[difficulty][1];
+    if (first == end) {
+        printf("No words available for the selected difficulty. Using all words.\n");
+        first = 0;
+        end = pack->size;
+    }
+    return embedded_word(pack, first + rand() % (end - first));
+}
+
+// index is the embedded pack behind sl, or NULL. with it, only the bucket of words with the right
+// length is scanned and wrong letters are checked against the precomputed letter masks
+const char* pick_dynamic_word(const StringList* sl, const Board* b, char guess, int word_length, GuessNode** guesses,
+                        const EmbeddedPack* index) {
     if (sl->size <= 0) return NULL;
 
     // Build a set of wrong-letters and revealed (present) letters from guesses in the revealed pattern
@@ -289,18 +627,32 @@ char* pick_dynamic_word(const StringList* sl, const Board* b, char guess, int wo
         char lc = g->ch;
         if (lc >= 'a' && lc <= 'z' && !present[lc - 'a']) wrong[lc - 'a'] = 1;
     }
+    uint32_t wrong_mask = 0;
+    for (int i = 0; i < 26; ++i)
+        if (wrong[i]) wrong_mask |= 1u << i;
+
+    int first = 0;
+    int end = sl->size;
+    if (index) {
+        first = end = 0;
+        if (word_length <= index->max_length) {
+            first = embedded_length_start(index, word_length);
+            end = embedded_length_start(index, word_length + 1);
+        }
+    }
     // Build a list of candidate words that match the current pattern and do not contain any wrong letters
     int cap = sl->size;
-    char** current = (char**)malloc((size_t)cap * sizeof(char*));
+    const char** current = (const char**)malloc((size_t)cap * sizeof(char*));
     if (!current) {
         perror("malloc error");
         exit(1);
     }
     int number_of_candidates = 0;
-    for (int i = 0; i < sl->size; ++i) {
+    for (int i = first; i < end; ++i) {
         const char* w = sl->data[i];
         // length must match the current word length
-        if ((int)strlen(w) != word_length) continue;
+        if (!index && (int)strlen(w) != word_length) continue;
+        if (index && (embedded_letter_mask(index, i) & wrong_mask)) continue;
         int ok = 1;
         // pattern matcher. every revealed position must match the candidate
         for (int j = 0; j < word_length; ++j) {
@@ -312,11 +664,11 @@ char* pick_dynamic_word(const StringList* sl, const Board* b, char guess, int wo
         }
         if (!ok) continue;
         // exclude words containing any letter we know is surely wrong
-        for (const char* p = w; ok && *p; ++p) {
+        for (const char* p = w; ok && !index && *p; ++p) {
             char lc = (char)tolower((unsigned char)*p);
             if (lc >= 'a' && lc <= 'z' && wrong[lc - 'a']) ok = 0;
         }
-        if (ok) current[number_of_candidates++] = (char*)w;
+        if (ok) current[number_of_candidates++] = w;
     }
 
     if (number_of_candidates == 0) {
@@ -342,10 +694,10 @@ char* pick_dynamic_word(const StringList* sl, const Board* b, char guess, int wo
     for (int i = 0; i < number_of_candidates; ++i) {
         if (strchr(current[i], guess) == NULL) avoidCount++;
     }
-    char* candidate = NULL;
+    const char* candidate = NULL;
     if (avoidCount > 0) {
         // build a list of words that avoid the current guess letters and pick from them
-        char** avoider_words = (char**)malloc((size_t)avoidCount * sizeof(char*));
+        const char** avoider_words = (const char**)malloc((size_t)avoidCount * sizeof(char*));
         int ai = 0;
         for (int i = 0; i < number_of_candidates; ++i) {
             if (strchr(current[i], guess) == NULL) avoider_words[ai++] = current[i];
@@ -388,9 +740,6 @@ char* pick_dynamic_word(const StringList* sl, const Board* b, char guess, int wo
 int main(void) {
     srand((unsigned)time(NULL)); // seed random number generator
 
-    StringList words;
-    sl_init(&words);
-
     Score score;
     score_init(&score);
 
@@ -400,6 +749,7 @@ int main(void) {
     board.max_hints = 3;      // Default maximum hints
     board.hints_used = 0;     // Initialize hints used
     int wordpack_choice = 1;  // Default word pack choice
+    pack_choice_preload(wordpack_choice);  // load the default pack while the menu is shown
 
     printf("\nWelcome to Hangman!\n");
     printf("-------------------\n");
@@ -481,33 +831,18 @@ int main(void) {
             }
         }
         if (menu_choice == '3') {
-            printf("\nWhich word pack would you like to use?\n");
-            int number_of_packs = (int)(sizeof(word_pack_paths) / sizeof(word_pack_paths[0]));
-            for (int i = 0; i < number_of_packs; ++i) {
-                printf("%d: %s\n", i + 1, word_pack_paths[i].name);
-            }
-            printf("Enter choice (1-%d): ", number_of_packs);
-            while (true) {
-                if (scanf(" %d", &wordpack_choice) != 1) {
-                    printf("\nInvalid input, try again: \n");
-                    while (getchar() != '\n');  // clear input buffer
-                    continue;
-                }
-                if (wordpack_choice < 1 || wordpack_choice > (int)(sizeof(word_pack_paths) / sizeof(word_pack_paths[0]))) {
-                    printf("\nOut of range, try again: \n");
-                    continue;
-                }
-                break;
-            }
+            wordpack_choice = choose_word_pack();
         }
         if (menu_choice == '4') {
             printf("Goodbye!\n");
+            pack_cache_shutdown();
             return 0;
         }
     }
 
-    load_words(word_pack_paths[wordpack_choice - 1].path, &words);
-    printf("Loaded %d words from %s.\n", words.size, word_pack_paths[wordpack_choice - 1].path);
+    ActivePack pack;
+    if (active_pack_open(&pack, wordpack_choice) != 0) exit(1);
+    printf("Loaded %d words from %s.\n", active_pack_words(&pack)->size, pack_choice_name(wordpack_choice));
     printf("Starting game with difficulty %d and max hints %d.\n", board.difficulty, board.max_hints);
 
     int playAgain = 1;
@@ -516,7 +851,11 @@ int main(void) {
     while (playAgain) {
         GuessNode* guesses = NULL; /* linked list of guesses for this round */
 
-        char* word = pick_random_word(&words, board.difficulty);
+        const char* word;
+        if (pack.embedded)
+            word = pick_embedded_word(pack.embedded, board.difficulty);
+        else
+            word = pick_random_word(active_pack_words(&pack), board.difficulty);
         board_reset(&board, word);
 
         int aborted = 0;
@@ -552,7 +891,8 @@ int main(void) {
             if (board.difficulty == 4) {
                 printf("\n-------------Evil Hangman debug info:-------------\n");
                 printf("Your original word was: %s\n", board.word);
-                word = pick_dynamic_word(&words, &board, guess, (int)strlen(board.word), &guesses);
+                word = pick_dynamic_word(active_pack_words(&pack), &board, guess, (int)strlen(board.word), &guesses,
+                                         pack.embedded);
                 board.word = word;
                 printf("The new word is: %s\n", board.word);
                 printf("--------------------------------------------------\n");
@@ -578,15 +918,27 @@ int main(void) {
         printf("Wins: %d, Losses: %d\n",
                score.wins, score.losses);
 
-        printf("Play again? (y/n): ");
+        printf("Play again? (y/n, or s to switch word pack): ");
         while (scanf(" %c", &letter) != 1) {
             printf("\nInvalid input, try again.\n");
         }  // read input string
-        playAgain = tolower(letter) == 'y';
+        playAgain = tolower(letter) == 'y' || tolower(letter) == 's';
         guess_list_free(guesses);
+
+        if (tolower(letter) == 's') {
+            int choice = choose_word_pack();
+            if (active_pack_switch(&pack, choice) == 0) {
+                wordpack_choice = choice;
+                printf("Switched to %s (%d words).\n", pack_choice_name(wordpack_choice),
+                       active_pack_words(&pack)->size);
+            } else {
+                printf("Keeping %s.\n", pack_choice_name(wordpack_choice));
+            }
+        }
     }
 
     free(board.renderedString);
-    sl_free(&words);
+    active_pack_close(&pack);
+    pack_cache_shutdown();
     return 0;
 }